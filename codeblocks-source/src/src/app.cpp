@@ -24,6 +24,7 @@
 #include <wx/msgout.h>
 #include <wx/notebook.h>
 #include <wx/regex.h>
+#include <wx/settings.h>
 #include <wx/stdpaths.h>
 #include <wx/xrc/xmlres.h>
 
@@ -36,6 +37,7 @@
 #include "compiler.h"
 #include "compilerfactory.h"
 #include "crashhandler.h"
+#include "darktheme.h"
 #include "debuggermanager.h"
 #include "editormanager.h"
 #include "globals.h"
@@ -329,6 +331,24 @@ public:
 };
 
 void cbMessageOutputNull::Output(cb_unused const wxString &str){}
+
+// Only reports the theme for now: Windows is forced into dark mode and the lexer
+// colours come in a dark variant only, so there is nothing to switch to yet.
+void LogSystemAppearance()
+{
+    const wxSystemAppearance appearance = wxSystemSettings::GetAppearance();
+#ifdef __WXMSW__
+    // IsDark() reports the forced mode here, ask for the user's app setting instead
+    const bool isDark = appearance.AreAppsDark();
+#else
+    const bool isDark = appearance.IsDark();
+#endif
+    wxString msg = wxString::Format("System appearance is %s", isDark ? "dark" : "light");
+    const wxString name = appearance.GetName(); // only provided by some ports
+    if (!name.empty())
+        msg += wxString::Format(" (%s)", name);
+    Manager::Get()->GetLogManager()->Log(msg);
+}
 } // namespace
 
 IMPLEMENT_APP(CodeBlocksApp) // TODO: This gives a "redundant declaration" warning, though I think it's false. Dig through macro and check.
@@ -412,6 +432,8 @@ bool CodeBlocksApp::LoadConfig()
 
     cfg->Write(_T("data_path"), data);
 
+    ApplyBuiltinTheme();
+
     //m_HasDebugLog = Manager::Get()->GetConfigManager(_T("message_manager"))->ReadBool(_T("/has_debug_log"), false) || m_HasDebugLog;
     //Manager::Get()->GetConfigManager(_T("message_manager"))->Write(_T("/has_debug_log"), m_HasDebugLog);
 
@@ -637,6 +659,8 @@ bool CodeBlocksApp::OnInit()
     log->Log(wxString::Format("Starting %s %s %s", appglobals::AppName,
                               appglobals::AppActualVersionVerb, appglobals::AppBuildTimestamp));
 
+    LogSystemAppearance();
+
     try
     {
     #if (wxUSE_ON_FATAL_EXCEPTION == 1)
@@ -750,6 +774,11 @@ bool CodeBlocksApp::OnInit()
         MainFrame* frame = nullptr;
         frame = InitFrame();
         m_Frame = frame;
+        frame->Bind(wxEVT_SYS_COLOUR_CHANGED, [](wxSysColourChangedEvent& event)
+        {
+            LogSystemAppearance();
+            event.Skip();
+        });
 
         {
             const double scalingFactor = cbGetContentScaleFactor(*frame);
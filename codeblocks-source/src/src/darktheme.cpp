@@ -0,0 +1,77 @@
+/*
+ * This file is part of the Code::Blocks IDE and licensed under the GNU General Public License, version 3
+ * http://www.gnu.org/licenses/gpl-3.0.html
+ */
+
+#include <sdk.h>
+#include "darktheme.h"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+#ifndef CB_PRECOMP
+    #include "configmanager.h"
+    #include "manager.h"
+#endif
+
+// Entries are written once per theme version (marked by /environment/builtin_theme_version),
+// so later changes by the user, including resets to the lexer defaults, are kept.
+void ApplyBuiltinTheme()
+{
+    ConfigManager* appCfg = Manager::Get()->GetConfigManager("app");
+    const int seeded = appCfg->ReadInt("/environment/builtin_theme_version", 0);
+    if (seeded >= darktheme::Version)
+        return;
+
+    for (const darktheme::ThemeColour& colour : darktheme::Colours)
+    {
+        ConfigManager* cfg = Manager::Get()->GetConfigManager(colour.nameSpace);
+        if (colour.version > seeded && !cfg->Exists(colour.path))
+            cfg->Write(colour.path, wxColour(colour.r, colour.g, colour.b));
+    }
+
+    ConfigManager* cfg = Manager::Get()->GetConfigManager("editor");
+    const wxString setKey("/colour_sets/default");
+    if (!cfg->Exists(setKey + "/name"))
+        cfg->Write(setKey + "/name", wxString("default"));
+
+    for (const darktheme::ThemeLanguage& lang : darktheme::Languages)
+    {
+        const wxString langKey = setKey + '/' + lang.key;
+
+        // the style keys are numbered per save, so look at the names already there
+        std::set<wxString> names;
+        long nextIndex = 0;
+        for (const wxString& path : cfg->EnumerateSubPaths(langKey))
+        {
+            long index;
+            if (!path.StartsWith("style") || !path.Mid(5).ToLong(&index))
+                continue;
+            names.insert(cfg->Read(langKey + '/' + path + "/name"));
+            nextIndex = std::max(nextIndex, index + 1);
+        }
+
+        // styles the user saved before any seeding make up their own set, leave it alone
+        if (seeded == 0 && !names.empty())
+            continue;
+
+        if (!cfg->Exists(langKey + "/name"))
+            cfg->Write(langKey + "/name", wxString(lang.name));
+
+        for (const darktheme::ThemeStyle& style : darktheme::Styles)
+        {
+            if (style.version <= seeded || std::strcmp(style.lang, lang.key) != 0
+                || !names.insert(style.name).second)
+            {
+                continue;
+            }
+
+            const wxString styleKey = wxString::Format("%s/style%ld", langKey, nextIndex++);
+            cfg->Write(styleKey + "/name", wxString(style.name));
+            cfg->Write(styleKey + (style.fore ? "/fore" : "/back"), wxColour(style.r, style.g, style.b));
+        }
+    }
+
+    appCfg->Write("/environment/builtin_theme_version", darktheme::Version);
+}
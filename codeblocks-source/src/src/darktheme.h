@@ -0,0 +1,97 @@
+/*
+ * This file is part of the Code::Blocks IDE and licensed under the GNU General Public License, version 3
+ * http://www.gnu.org/licenses/gpl-3.0.html
+ */
+
+#ifndef DARKTHEME_H
+#define DARKTHEME_H
+
+// Built-in dark theme, the single source of these colours. It is plain data so that
+// tools/ThemeCheck can include it as well and check it against the lexer files.
+namespace darktheme
+{
+    // Bump this when entries are added, and give the new entries this version:
+    // ApplyBuiltinTheme() only seeds entries newer than what a config has seen.
+    constexpr int Version = 1;
+
+    struct ThemeColour
+    {
+        int           version;
+        const char*   nameSpace;
+        const char*   path;
+        unsigned char r, g, b;
+    };
+
+    constexpr ThemeColour Colours[] =
+    {
+        { 1, "app",             "/environment/aui/active_caption_colour",            119, 119, 119 },
+        { 1, "app",             "/environment/aui/active_caption_gradient_colour",   200, 200, 200 },
+        { 1, "app",             "/environment/aui/active_caption_text_colour",       224, 224, 224 },
+        { 1, "app",             "/environment/aui/inactive_caption_colour",           27,  27,  27 },
+        { 1, "app",             "/environment/aui/inactive_caption_gradient_colour",  31,  31,  31 },
+        { 1, "app",             "/environment/aui/inactive_caption_text_colour",     170, 170, 170 },
+        { 1, "colours",         "/list/start_here_link",                             170, 170, 255 },
+        { 1, "colours",         "/list/cc_docs_back",                                 32,  32,  32 },
+        { 1, "colours",         "/list/cc_docs_link",                                170, 170, 255 },
+        { 1, "colours",         "/list/cc_docs_fore",                                255, 255, 255 },
+        { 1, "colours",         "/list/cc_tips_back",                                 68,  68,  68 },
+        { 1, "colours",         "/list/cc_tips_fore",                                255, 255, 255 },
+        { 1, "colours",         "/list/cc_tips_highlight",                           170, 170, 255 },
+        { 1, "colours",         "/list/editor_caret",                                254, 255, 255 },
+        { 1, "code_completion", "/documentation_helper_background_color",             32,  32,  32 },
+        { 1, "code_completion", "/documentation_helper_text_color",                  255, 255, 255 },
+        { 1, "code_completion", "/documentation_helper_link_color",                  170, 170, 255 },
+        { 1, "editor",          "/incremental_search/text_found_colour",             160,  32, 240 },
+        { 1, "editor",          "/incremental_search/highlight_colour",              255, 165,   0 },
+        { 1, "editor",          "/incremental_search/text_not_found_colour",         255, 127, 127 },
+        { 1, "editor",          "/incremental_search/wrapped_colour",                127, 127, 255 }
+    };
+
+    // Languages of the "default" colour set that have overrides, keyed like EditorColourSet
+    struct ThemeLanguage
+    {
+        const char* key;
+        const char* name;
+    };
+
+    constexpr ThemeLanguage Languages[] =
+    {
+        { "cc", "C/C++" }
+    };
+
+    // Overrides of the lexer defaults, EditorColourSet matches them by option name
+    struct ThemeStyle
+    {
+        int           version;
+        const char*   lang;
+        const char*   name;
+        bool          fore;
+        unsigned char r, g, b;
+    };
+
+    constexpr ThemeStyle Styles[] =
+    {
+        { 1, "cc", "Default",                                false,  31,  31,  31 },
+        { 1, "cc", "Default (inactive)",                     true,  157, 157, 157 },
+        { 1, "cc", "Comment (inactive)",                     true,  117, 117, 117 },
+        { 1, "cc", "Comment line (inactive)",                true,  116, 116, 116 },
+        { 1, "cc", "Comment (documentation, inactive)",      true,   68,  68, 151 },
+        { 1, "cc", "Comment line (documentation, inactive)", true,   68,  68, 151 },
+        { 1, "cc", "Number (inactive)",                      true,  146,  82, 146 },
+        { 1, "cc", "Keyword",                                true,   86, 156, 214 },
+        { 1, "cc", "Keyword (inactive)",                     true,   41,  89, 129 },
+        { 1, "cc", "User keyword (inactive)",                true,   66, 119,  66 },
+        { 1, "cc", "String",                                 true,  206, 145, 120 },
+        { 1, "cc", "String (inactive)",                      true,  141,  92,  71 },
+        { 1, "cc", "Character (inactive)",                   true,  137, 115,  54 },
+        { 1, "cc", "Preprocessor (inactive)",                true,   81, 104,  81 },
+        { 1, "cc", "Operator",                               true,  255, 126,  64 },
+        { 1, "cc", "Operator (inactive)",                    true,  117,  46,  11 },
+        { 1, "cc", "Selection",                              false,  68,  68,  68 }
+    };
+}
+
+// Seeds the built-in theme into the configuration, call it once the config is loaded
+void ApplyBuiltinTheme();
+
+#endif // DARKTHEME_H
@@ -0,0 +1,442 @@
+/*
+ * This file is part of the Code::Blocks IDE and licensed under the GNU General Public License, version 3
+ * http://www.gnu.org/licenses/gpl-3.0.html
+ */
+
+// Checks the colours of all lexer_*.xml files, with the built-in dark theme of
+// src/darktheme.h and optionally the colour sets of a configuration file like default.conf
+// applied on top, against the WCAG contrast ratio, so unreadable style combinations are
+// caught before they are shipped.
+//
+// Usage: themecheck [--min <ratio>] [--min-inactive <ratio>] <lexers dir> [<config file>]
+//
+// Exit code is 0 if all styles pass, 1 if violations were found and 2 on errors.
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "darktheme.h"
+#include "tinyxml.h"
+
+namespace
+{
+
+struct Colour
+{
+    int  r = 0, g = 0, b = 0;
+    bool valid = false;
+};
+
+struct Option
+{
+    std::string      name;
+    std::vector<int> indices; // a <Style> can apply to several Scintilla styles
+    Colour           fore;
+    Colour           back;
+};
+
+struct Lexer
+{
+    std::string         file;
+    std::string         name;
+    std::string         lang; // key used by the colour sets, e.g. "cc" for "C/C++"
+    std::vector<Option> options;
+    std::string         error;
+};
+
+struct ColourSet
+{
+    std::string                                          source; // file it comes from
+    std::string                                          name;
+    std::map<std::string, std::map<std::string, Option>> langs; // lang -> option name -> override
+};
+
+// Scintilla styles from this index on are used for code inside disabled #if blocks
+const int inactiveStyleOffset = 64;
+
+double s_MinRatio         = 4.5; // WCAG AA for normal text
+double s_MinInactiveRatio = 3.0; // inactive code is dimmed on purpose
+
+std::string Trim(const std::string& str)
+{
+    const std::string::size_type first = str.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+        return std::string();
+    const std::string::size_type last = str.find_last_not_of(" \t\r\n");
+    return str.substr(first, last - first + 1);
+}
+
+// Accepts "r,g,b" and "#rrggbb", like EditorColourSet does
+Colour ParseColour(const char* value)
+{
+    Colour colour;
+    if (!value)
+        return colour;
+
+    const std::string str = Trim(value);
+    if (str.size() == 7 && str[0] == '#')
+    {
+        const long rgb = std::strtol(str.c_str() + 1, nullptr, 16);
+        colour.r = (rgb >> 16) & 0xFF;
+        colour.g = (rgb >>  8) & 0xFF;
+        colour.b =  rgb        & 0xFF;
+        colour.valid = true;
+    }
+    else if (std::sscanf(str.c_str(), "%d,%d,%d", &colour.r, &colour.g, &colour.b) == 3)
+        colour.valid = true;
+
+    return colour;
+}
+
+Colour ReadConfigColour(const TiXmlElement* parent, const char* key)
+{
+    Colour colour;
+    const TiXmlElement* elem = parent->FirstChildElement(key);
+    elem = elem ? elem->FirstChildElement("colour") : nullptr;
+    if (elem && elem->Attribute("r", &colour.r) && elem->Attribute("g", &colour.g)
+        && elem->Attribute("b", &colour.b))
+    {
+        colour.valid = true;
+    }
+    return colour;
+}
+
+std::string ReadConfigString(const TiXmlElement* parent, const char* key)
+{
+    const TiXmlElement* elem = parent->FirstChildElement(key);
+    elem = elem ? elem->FirstChildElement("str") : nullptr;
+    return (elem && elem->GetText()) ? Trim(elem->GetText()) : std::string();
+}
+
+// Same rule as EditorColourSet::AddHighlightLanguage(): keep alphanumerics and '_', turn
+// whitespace into '_' and prepend 'A' to ids starting with a digit or '_'. Config paths
+// are lower case, e.g. "Motorola 68k" is stored as "motorola_68k".
+std::string LanguageKey(const std::string& name)
+{
+    std::string key;
+    for (const char c : name)
+    {
+        const unsigned char ch = static_cast<unsigned char>(c);
+        if (std::isalnum(ch) || ch == '_')
+            key += c;
+        else if (std::isspace(ch))
+            key += '_';
+    }
+    if (!key.empty() && (std::isdigit(static_cast<unsigned char>(key[0])) || key[0] == '_'))
+        key.insert(0, 1, 'A');
+
+    for (char& c : key)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return key;
+}
+
+void LoadLexer(Lexer& lexer)
+{
+    TiXmlDocument doc;
+    if (!doc.LoadFile(lexer.file.c_str()))
+    {
+        lexer.error = doc.ErrorDesc();
+        return;
+    }
+
+    const TiXmlElement* root = doc.FirstChildElement("CodeBlocks_lexer_properties");
+    const TiXmlElement* elem = root ? root->FirstChildElement("Lexer") : nullptr;
+    if (!elem || !elem->Attribute("name"))
+    {
+        lexer.error = "no <Lexer> element";
+        return;
+    }
+
+    lexer.name = elem->Attribute("name");
+    lexer.lang = LanguageKey(lexer.name);
+
+    for (const TiXmlElement* style = elem->FirstChildElement("Style"); style;
+         style = style->NextSiblingElement("Style"))
+    {
+        Option opt;
+        opt.name = style->Attribute("name") ? style->Attribute("name") : "";
+        opt.fore = ParseColour(style->Attribute("fg"));
+        opt.back = ParseColour(style->Attribute("bg"));
+
+        std::istringstream indices(style->Attribute("index") ? style->Attribute("index") : "");
+        std::string token;
+        while (std::getline(indices, token, ','))
+            opt.indices.push_back(std::atoi(token.c_str()));
+
+        lexer.options.push_back(opt);
+    }
+}
+
+bool LoadColourSets(const std::string& file, std::vector<ColourSet>& sets)
+{
+    TiXmlDocument doc;
+    if (!doc.LoadFile(file.c_str()))
+    {
+        std::fprintf(stderr, "%s: %s\n", file.c_str(), doc.ErrorDesc());
+        return false;
+    }
+
+    const TiXmlElement* elem = doc.FirstChildElement("CodeBlocksConfig");
+    elem = elem ? elem->FirstChildElement("editor")      : nullptr;
+    elem = elem ? elem->FirstChildElement("colour_sets") : nullptr;
+    if (!elem)
+        return true; // nothing customised
+
+    for (const TiXmlElement* setElem = elem->FirstChildElement(); setElem;
+         setElem = setElem->NextSiblingElement())
+    {
+        const std::string name = ReadConfigString(setElem, "NAME");
+        if (name.empty())
+            continue; // ACTIVE_COLOUR_SET, ACTIVE_LANG, ...
+
+        ColourSet set;
+        set.name = name;
+        for (const TiXmlElement* langElem = setElem->FirstChildElement(); langElem;
+             langElem = langElem->NextSiblingElement())
+        {
+            for (const TiXmlElement* styleElem = langElem->FirstChildElement(); styleElem;
+                 styleElem = styleElem->NextSiblingElement())
+            {
+                if (std::strncmp(styleElem->Value(), "style", 5) != 0)
+                    continue;
+
+                Option opt;
+                opt.name = ReadConfigString(styleElem, "NAME");
+                opt.fore = ReadConfigColour(styleElem, "FORE");
+                opt.back = ReadConfigColour(styleElem, "BACK");
+                if (!opt.name.empty())
+                    set.langs[langElem->Value()][opt.name] = opt;
+            }
+        }
+        set.source = std::filesystem::path(file).filename().string();
+        sets.push_back(set);
+    }
+    return true;
+}
+
+double Luminance(const Colour& colour)
+{
+    auto channel = [](int value)
+    {
+        const double c = value / 255.0;
+        return c <= 0.03928 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+    };
+    return 0.2126 * channel(colour.r) + 0.7152 * channel(colour.g) + 0.0722 * channel(colour.b);
+}
+
+double ContrastRatio(const Colour& fore, const Colour& back)
+{
+    const double l1 = Luminance(fore);
+    const double l2 = Luminance(back);
+    return (std::max(l1, l2) + 0.05) / (std::min(l1, l2) + 0.05);
+}
+
+// Resolves the colours the editor would use and reports all styles below the threshold.
+// Returns the number of violations.
+int CheckLexer(const std::string& prefix, const std::vector<Option>& options)
+{
+    // styles without a colour inherit the one of the option named "Default", like
+    // EditorColourSet::Apply() does
+    Colour defFore{0, 0, 0, true};
+    Colour defBack{255, 255, 255, true};
+    for (const Option& opt : options)
+    {
+        if (opt.name != "Default")
+            continue;
+        if (opt.fore.valid)
+            defFore = opt.fore;
+        if (opt.back.valid)
+            defBack = opt.back;
+        break;
+    }
+
+    int violations = 0;
+    for (const Option& opt : options)
+    {
+        // line markers (breakpoint, debugger line, ...) have negative indices and only a
+        // background; a style mixing active and inactive indices gets the stricter limit
+        bool hasText     = false;
+        bool allInactive = true;
+        std::string indexList;
+        for (const int index : opt.indices)
+        {
+            if (index < 0)
+                continue;
+            hasText = true;
+            allInactive = allInactive && index >= inactiveStyleOffset;
+            indexList += (indexList.empty() ? "" : ",") + std::to_string(index);
+        }
+        if (!hasText)
+            continue;
+
+        const Colour fore = opt.fore.valid ? opt.fore : defFore;
+        const Colour back = opt.back.valid ? opt.back : defBack;
+        const double required = allInactive ? s_MinInactiveRatio : s_MinRatio;
+        const double ratio = ContrastRatio(fore, back);
+        if (ratio >= required)
+            continue;
+
+        std::printf("%s: style %s \"%s\": contrast %.2f < %.2f (fg %d,%d,%d on bg %d,%d,%d)\n",
+                    prefix.c_str(), indexList.c_str(), opt.name.c_str(), ratio, required,
+                    fore.r, fore.g, fore.b, back.r, back.g, back.b);
+        ++violations;
+    }
+    return violations;
+}
+
+void Usage()
+{
+    std::fprintf(stderr,
+                 "Usage: themecheck [--min <ratio>] [--min-inactive <ratio>] <lexers dir> [<config file>]\n"
+                 "  --min <ratio>           minimum contrast for normal styles (default %.1f)\n"
+                 "  --min-inactive <ratio>  minimum contrast for inactive styles, index %d+ (default %.1f)\n",
+                 s_MinRatio, inactiveStyleOffset, s_MinInactiveRatio);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string lexersDir;
+    std::string configFile;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if ((arg == "--min" || arg == "--min-inactive") && i + 1 < argc)
+            (arg == "--min" ? s_MinRatio : s_MinInactiveRatio) = std::atof(argv[++i]);
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            Usage();
+            return 2;
+        }
+        else if (lexersDir.empty())
+            lexersDir = arg;
+        else if (configFile.empty())
+            configFile = arg;
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+
+    if (lexersDir.empty())
+    {
+        Usage();
+        return 2;
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::vector<Lexer> lexers;
+    std::error_code ec;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(lexersDir, ec))
+    {
+        const std::string fileName = entry.path().filename().string();
+        if (fileName.compare(0, 6, "lexer_") == 0 && entry.path().extension() == ".xml")
+        {
+            Lexer lexer;
+            lexer.file = entry.path().string();
+            lexers.push_back(lexer);
+        }
+    }
+    if (ec)
+    {
+        std::fprintf(stderr, "%s: %s\n", lexersDir.c_str(), ec.message().c_str());
+        return 2;
+    }
+    // directory order is unspecified, keep the report stable
+    std::sort(lexers.begin(), lexers.end(),
+              [](const Lexer& a, const Lexer& b) { return a.file < b.file; });
+
+    // parsing dominates the run time, spread it over all cores
+    std::atomic<size_t> next(0);
+    const unsigned threadCount = std::max(1u, std::min<unsigned>(std::thread::hardware_concurrency(),
+                                                                 lexers.size()));
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&lexers, &next]()
+        {
+            for (size_t idx = next++; idx < lexers.size(); idx = next++)
+                LoadLexer(lexers[idx]);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::vector<ColourSet> sets;
+
+    ColourSet builtin;
+    builtin.source = "darktheme.h";
+    builtin.name   = "default";
+    for (const darktheme::ThemeStyle& style : darktheme::Styles)
+    {
+        Option& opt = builtin.langs[style.lang][style.name];
+        opt.name = style.name;
+        (style.fore ? opt.fore : opt.back) = Colour{style.r, style.g, style.b, true};
+    }
+    sets.push_back(builtin);
+
+    if (!configFile.empty() && !LoadColourSets(configFile, sets))
+        return 2;
+
+    int errors = 0;
+    int violations = 0;
+    for (const Lexer& lexer : lexers)
+    {
+        const std::string fileName = std::filesystem::path(lexer.file).filename().string();
+        if (!lexer.error.empty())
+        {
+            std::fprintf(stderr, "%s: %s\n", fileName.c_str(), lexer.error.c_str());
+            ++errors;
+            continue;
+        }
+
+        violations += CheckLexer(fileName + ": " + lexer.name, lexer.options);
+
+        // only languages a colour set customises can add new violations
+        for (const ColourSet& set : sets)
+        {
+            const auto lang = set.langs.find(lexer.lang);
+            if (lang == set.langs.end())
+                continue;
+
+            std::vector<Option> options = lexer.options;
+            for (Option& opt : options)
+            {
+                const auto custom = lang->second.find(opt.name);
+                if (custom == lang->second.end())
+                    continue;
+                if (custom->second.fore.valid)
+                    opt.fore = custom->second.fore;
+                if (custom->second.back.valid)
+                    opt.back = custom->second.back;
+            }
+
+            violations += CheckLexer(set.source + " [" + set.name + "]: " + lexer.name, options);
+        }
+    }
+
+    const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()
+                                                                     - start).count();
+    std::printf("%d lexer(s), %d colour set(s): %d violation(s), %d error(s) in %.1f ms\n",
+                static_cast<int>(lexers.size()), static_cast<int>(sets.size()), violations, errors,
+                elapsed);
+
+    if (errors)
+        return 2;
+    return violations ? 1 : 0;
+}